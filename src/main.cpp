@@ -1,4 +1,5 @@
 #include <raylib.h>
+#include <rlgl.h>
 #include<iostream>
 #include<deque>
 #include <cmath>
@@ -13,6 +14,10 @@ int cellCount = 30;
 int offset = 75;
 double lastUpdateTime = 0;
 
+// Frame pacing
+int targetFPS = 60;                       // Fixed-rate presentation mode
+double inputPollInterval = 1.0 / targetFPS; // Max sleep between input polls while waiting for a tick
+
 // Global texture for background image
 Texture2D backgroundTexture;
 
@@ -48,6 +53,54 @@ bool eventHappened(double interval) {
     return false;
 }
 
+double nextEventTime(double interval) {
+    return lastUpdateTime + interval;
+}
+
+// Frame counters for one presentation mode, reported on exit
+struct PresentationStats {
+    double elapsed = 0;     // Wall time spent in this mode
+    double workTime = 0;    // Wall time in Update, Draw and batch flush; excludes swap, input poll and sleep
+    long iterations = 0;
+    long framesDrawn = 0;
+};
+
+void PrintPresentationStats(const char* label, const PresentationStats& stats) {
+    double elapsed = fmax(stats.elapsed, 0.001);
+    cout<<TextFormat("[%s] %.1f s: %ld frames drawn (%.1f fps), %ld loop iterations",
+                     label, stats.elapsed, stats.framesDrawn, stats.framesDrawn / elapsed,
+                     stats.iterations)<<endl;
+    cout<<TextFormat("[%s] update+draw+flush work: %.3f s (%.2f%% of wall time; wall-clock, not process CPU time, "
+                     "excludes buffer swap and input poll)",
+                     label, stats.workTime, 100.0 * stats.workTime / elapsed)<<endl;
+}
+
+// Reports both modes, comparing event-driven against the measured fixed-rate figures
+void PrintPresentationReport(const PresentationStats& fixed, const PresentationStats& event) {
+    if (fixed.iterations > 0) {
+        PrintPresentationStats("fixed", fixed);
+    }
+    if (event.iterations == 0) {
+        return;
+    }
+    PrintPresentationStats("event-driven", event);
+
+    double eventFps = event.framesDrawn / fmax(event.elapsed, 0.001);
+    if (fixed.iterations == 0) {
+        // No fixed-rate run to compare against, so only the nominal frame rate is known
+        cout<<TextFormat("[event-driven] %.1f%% fewer frames than nominal %d FPS (press F2 to measure fixed mode)",
+                         100.0 * (1.0 - eventFps / targetFPS), targetFPS)<<endl;
+        return;
+    }
+
+    double fixedFps = fixed.framesDrawn / fmax(fixed.elapsed, 0.001);
+    double fixedLoad = fixed.workTime / fmax(fixed.elapsed, 0.001);
+    double eventLoad = event.workTime / fmax(event.elapsed, 0.001);
+    cout<<TextFormat("[event-driven] vs measured fixed mode: %.1f%% fewer frames per second, %.1f%% less frame work per second",
+                     fixedFps > 0 ? 100.0 * (1.0 - eventFps / fixedFps) : 0.0,
+                     fixedLoad > 0 ? 100.0 * (1.0 - eventLoad / fixedLoad) : 0.0)<<endl;
+}
+
 // Difficulty manager to handle game speeds
 class DifficultyManager {
 public:
@@ -194,14 +247,43 @@ private:
     Food food;
     int finalScore; // Store the final score when game ends
     int highScore;  // Store the highest score achieved
+    bool needsRedraw;   // Set whenever the next frame would differ from the last one presented
+    int hoveredButton;  // Index of the menu button under the mouse, -1 if none
+    bool quitRequested;
     
 public:
     GameManager() : currentState(GameState::MAIN_MENU), selectedDifficulty(DifficultyLevel::MEDIUM), 
                    gameSpeed(DifficultyManager::getSpeed(selectedDifficulty)), food(snake.body), 
-                   finalScore(0), highScore(0) {
+                   finalScore(0), highScore(0), needsRedraw(true), hoveredButton(-1), quitRequested(false) {
+    }
+
+    void RequestRedraw() {
+        needsRedraw = true;
+    }
+
+    // Returns true once per pending redraw
+    bool ConsumeRedraw() {
+        bool redraw = needsRedraw;
+        needsRedraw = false;
+        return redraw;
+    }
+
+    // Only the PLAYING state changes on its own; every other screen waits for input
+    bool IsTicking() const {
+        return currentState == GameState::PLAYING;
+    }
+
+    double GetNextTickTime() const {
+        return nextEventTime(gameSpeed);
+    }
+
+    bool ShouldQuit() const {
+        return quitRequested;
     }
 
     void Update() {
+        GameState previousState = currentState;
+
         switch (currentState) {
             case GameState::MAIN_MENU:
                 UpdateMainMenu();
@@ -216,6 +298,11 @@ public:
                 UpdateGameOver();
                 break;
         }
+
+        if (currentState != previousState) {
+            hoveredButton = -1;
+            RequestRedraw();
+        }
     }
 
     void Draw() {
@@ -237,6 +324,13 @@ public:
 
 private:
 
+    void TrackHover(int button) {
+        if (button != hoveredButton) {
+            hoveredButton = button;
+            RequestRedraw();
+        }
+    }
+
     void UpdateMainMenu() {
         Vector2 mousePoint = GetMousePosition();
         
@@ -244,12 +338,17 @@ private:
         Rectangle playBtn = { GetScreenWidth()/2.0f - 100, GetScreenHeight()/2.0f - 25, 200, 50 };
         Rectangle exitBtn = { GetScreenWidth()/2.0f - 100, GetScreenHeight()/2.0f + 50, 200, 50 };
 
+        // Redraw only when the hovered button changes
+        if (CheckCollisionPointRec(mousePoint, playBtn)) TrackHover(0);
+        else if (CheckCollisionPointRec(mousePoint, exitBtn)) TrackHover(1);
+        else TrackHover(-1);
+
         // Check button clicks
         if (CheckCollisionPointRec(mousePoint, playBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             currentState = GameState::DIFFICULTY_MENU;
         }
         else if (CheckCollisionPointRec(mousePoint, exitBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            exit(0);
+            quitRequested = true;
         }
     }
 
@@ -262,6 +361,13 @@ private:
         Rectangle advancedBtn = { GetScreenWidth()/2.0f - 100, GetScreenHeight()/2.0f + 40, 200, 50 };
         Rectangle backBtn = { GetScreenWidth()/2.0f - 100, GetScreenHeight()/2.0f + 100, 200, 50 };
 
+        // Redraw only when the hovered button changes
+        if (CheckCollisionPointRec(mousePoint, beginnerBtn)) TrackHover(0);
+        else if (CheckCollisionPointRec(mousePoint, mediumBtn)) TrackHover(1);
+        else if (CheckCollisionPointRec(mousePoint, advancedBtn)) TrackHover(2);
+        else if (CheckCollisionPointRec(mousePoint, backBtn)) TrackHover(3);
+        else TrackHover(-1);
+
         // Check button clicks
         if (CheckCollisionPointRec(mousePoint, beginnerBtn) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             StartGame(DifficultyLevel::BEGINNER);
@@ -285,6 +391,7 @@ private:
     void UpdateGame() {
         if (eventHappened(gameSpeed)) {
             snake.Update();
+            RequestRedraw(); // The board only changes on a tick
         
             // Check collision between snake and food
             if (snake.body[0].x == food.position.x && snake.body[0].y == food.position.y) {
@@ -630,24 +737,78 @@ int main()
 {
     cout<<"Starting Snake Game..."<<endl;
     InitWindow(2*offset+cellCount*cellSize, 2*offset+cellCount*cellSize, "Snake Game - Menu");
-    SetTargetFPS(60);
+    // Event-driven presentation: frames are only drawn on input, hover change or a
+    // simulation tick, and the loop paces itself. Fixed-rate mode (F2) lets
+    // EndDrawing pace the loop at targetFPS exactly as before
+    bool eventDriven = true;
+    SetTargetFPS(0);
 
     // Load background image
     backgroundTexture = LoadTexture("c:\\Users\\PWIT\\Desktop\\Raylib-CPP-Starter-Template-for-VSCODE-V2-main\\pic.png");
 
     GameManager gameManager;
+    PresentationStats fixedStats;
+    PresentationStats eventStats;
+    bool wasFocused = IsWindowFocused();
 
-    while(!WindowShouldClose()) 
+    while(!WindowShouldClose() && !gameManager.ShouldQuit()) 
     {
+        // F2 toggles between event-driven and fixed-rate presentation
+        if (IsKeyPressed(KEY_F2)) {
+            eventDriven = !eventDriven;
+            SetTargetFPS(eventDriven ? 0 : targetFPS);
+            gameManager.RequestRedraw();
+        }
+
+        PresentationStats& stats = eventDriven ? eventStats : fixedStats;
+        double frameStart = GetTime();
+
         // Update game logic
         gameManager.Update();
 
-        // Draw everything
-        BeginDrawing();
-        gameManager.Draw();
-        EndDrawing();
+        // The window contents may need repainting after a resize or focus change
+        if (IsWindowResized() || IsWindowFocused() != wasFocused) {
+            wasFocused = IsWindowFocused();
+            gameManager.RequestRedraw();
+        }
+
+        bool redraw = gameManager.ConsumeRedraw() || !eventDriven;
+        if (redraw) {
+            // Draw everything. The batch is flushed explicitly so its cost is counted;
+            // EndDrawing then swaps buffers, sleeps in fixed-rate mode and polls input
+            BeginDrawing();
+            gameManager.Draw();
+            rlDrawRenderBatchActive();
+            stats.workTime += GetTime() - frameStart;
+            EndDrawing();
+            stats.framesDrawn++;
+        } else {
+            // Timed before sleeping and polling, matching drawn frames where the poll
+            // runs inside EndDrawing after the timestamp
+            stats.workTime += GetTime() - frameStart;
+
+            // Sleep towards the next tick, polling input at the fixed frame rate so
+            // key presses are seen as soon as before without waking more often
+            if (gameManager.IsTicking()) {
+                double remaining = gameManager.GetNextTickTime() - GetTime();
+                if (remaining > 0) {
+                    WaitTime(fmin(remaining, inputPollInterval));
+                }
+                PollInputEvents();
+            } else {
+                // Menus and game over block until the next OS event
+                EnableEventWaiting();
+                PollInputEvents();
+                DisableEventWaiting();
+            }
+        }
+
+        stats.iterations++;
+        stats.elapsed += GetTime() - frameStart;
     }
 
+    PrintPresentationReport(fixedStats, eventStats);
+
     // Unload texture
     if (backgroundTexture.id > 0) {
         UnloadTexture(backgroundTexture);